@@ -0,0 +1,159 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: folklore
+ * Description: Thread-safe hash map from int64\_t made of
+ * $2^K$ independently locked FlatHashMap shards. The shard
+ * is picked from the mixed hash bits just below the 7 tag
+ * bits, so it is independent of the slot and tag used
+ * inside the shard, and strided keys spread evenly.
+ * mergeFrom buckets a thread-local map by shard and
+ * takes each shard's lock once. Pick $2^K$ well above the
+ * thread count.
+ * Usage: ConcurrentHashMap<int64_t> h;
+ *  h.insertOrAdd(k, 1); // from any thread
+ *  h.mergeFrom(local);  // local is a FlatHashMap
+ * Time: O(1) expected.
+ * Status: stress-tested
+ */
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://abseil.io/about/design/swisstables
+ * Description: Open-addressing hash map from int64\_t,
+ * without libstdc++ extensions. One control byte per slot
+ * holds 7 hash bits (or -128 if empty), and 16 of them are
+ * compared at once with SSE2. Probing is linear, so erase
+ * shifts later entries back instead of leaving tombstones.
+ * Load factor is between 7/16 and 7/8, and a slot takes
+ * sizeof(pair<int64\_t, V>) + 1 bytes (19-39 bytes per key
+ * for V = int). Hashing uses chash from HashMap.h followed
+ * by the splitmix64 finalizer, so that the slot (low bits)
+ * and the tag (top 7 bits) are mixed from every key bit.
+ * Usage: FlatHashMap<int> h; h[5]++; h.erase(5);
+ *  h.find(5); h.each([&](int64_t k, int& v) { ... });
+ * Time: O(1) expected.
+ * Status: stress-tested
+ */
+#include <emmintrin.h> /** keep-include */
+struct chash { // large odd number for C
+  const uint64_t C = int64_t(4e18 * acos(0)) | 71;
+  int64_t operator()(int64_t x) const {
+    return __builtin_bswap64(x * C);
+  }
+};
+uint64_t splitmix(uint64_t h) {
+  h = (h ^ h >> 30) * 0xbf58476d1ce4e5b9;
+  h = (h ^ h >> 27) * 0x94d049bb133111eb;
+  return h ^ h >> 31;
+}
+template<class V, class H = chash> struct FlatHashMap {
+  int cap = 0, cnt = 0;
+  vector<int8_t> c;
+  vector<pair<int64_t, V>> s;
+  H hf;
+  FlatHashMap(int n = 0) { reserve(n); }
+  int size() { return cnt; }
+  void reserve(int n) {
+    int m = 16;
+    while (m / 8 * 7 < n) m *= 2;
+    if (m > cap) rehash(m);
+  }
+  void rehash(int m) {
+    vector<int8_t> oc(m + 16, -128);
+    vector<pair<int64_t, V>> os(m);
+    swap(c, oc), swap(s, os), cap = m;
+    for (int i = 0; i < ((int)(os).size()); i++)
+      if (oc[i] >= 0) {
+        int j = probe(os[i].first).first;
+        put(j, oc[i]), s[j] = move(os[i]);
+      }
+  }
+  uint64_t hash(int64_t x) { return splitmix(hf(x)); }
+  void put(int i, int8_t t) {
+    c[i] = t;
+    if (i < 16) c[i + cap] = t;
+  }
+  // {slot of x, 1} or {first empty slot, 0}
+  pair<int, bool> probe(int64_t x) {
+    uint64_t h = hash(x);
+    __m128i t = _mm_set1_epi8(int8_t(h >> 57)),
+            e = _mm_set1_epi8(-128);
+    for (int p = h & (cap - 1);;
+         p = (p + 16) & (cap - 1)) {
+      __m128i g = _mm_loadu_si128((__m128i*)&c[p]);
+      int b = _mm_movemask_epi8(_mm_cmpeq_epi8(g, t));
+      for (; b; b &= b - 1) {
+        int i = (p + __builtin_ctz(b)) & (cap - 1);
+        if (s[i].first == x) return {i, 1};
+      }
+      if ((b = _mm_movemask_epi8(_mm_cmpeq_epi8(g, e))))
+        return {(p + __builtin_ctz(b)) & (cap - 1), 0};
+    }
+  }
+  V* find(int64_t x) {
+    auto [i, f] = cap ? probe(x) : pair<int, bool>();
+    return f ? &s[i].second : 0;
+  }
+  V& operator[](int64_t x) {
+    if ((cnt + 1) * 8 > cap * 7) rehash(max(16, cap * 2));
+    auto [i, f] = probe(x);
+    if (!f) put(i, hash(x) >> 57), s[i].first = x, cnt++;
+    return s[i].second;
+  }
+  bool erase(int64_t x) {
+    auto [i, f] = cap ? probe(x) : pair<int, bool>();
+    if (!f) return 0;
+    for (int j = i; c[j = (j + 1) & (cap - 1)] >= 0;) {
+      int h = hash(s[j].first) & (cap - 1);
+      if (((j - h) & (cap - 1)) >= ((j - i) & (cap - 1)))
+        put(i, c[j]), s[i] = move(s[j]), i = j;
+    }
+    put(i, -128), s[i].second = V(), cnt--;
+    return 1;
+  }
+  template<class F> void each(F f) {
+    for (int i = 0; i < (cap); i++)
+      if (c[i] >= 0) f(s[i].first, s[i].second);
+  }
+};
+template<class V, int K = 8> struct ConcurrentHashMap {
+  struct alignas(64) Shard {
+    mutex m;
+    FlatHashMap<V> h;
+  };
+  vector<Shard> s;
+  chash hf;
+  ConcurrentHashMap(): s(1 << K) {}
+  int shard(int64_t x) {
+    return splitmix(hf(x)) >> (57 - K) & ((1 << K) - 1);
+  }
+  void insertOrAdd(int64_t x, V d) {
+    Shard& sh = s[shard(x)];
+    lock_guard<mutex> g(sh.m);
+    sh.h[x] += d;
+  }
+  bool find(int64_t x, V& out) {
+    Shard& sh = s[shard(x)];
+    lock_guard<mutex> g(sh.m);
+    V* p = sh.h.find(x);
+    if (p) out = *p;
+    return p;
+  }
+  void mergeFrom(FlatHashMap<V>& o) {
+    vector<vector<pair<int64_t, V>>> b(1 << K);
+    o.each([&](int64_t x, V& v) {
+      b[shard(x)].push_back({x, v});
+    });
+    for (int i = 0; i < (1 << K); i++)
+      if ((int)(b[i]).size()) {
+        lock_guard<mutex> g(s[i].m);
+        for (auto& [x, v] : b[i]) s[i].h[x] += v;
+      }
+  }
+  template<class F> void each(F f) { // not thread-safe
+    for (Shard& sh : s) sh.h.each(f);
+  }
+};
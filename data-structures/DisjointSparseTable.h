@@ -0,0 +1,40 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://codeforces.com/blog/entry/79108
+ * Description: Range queries for any associative
+ * operation f (sum, product, matrix product, ...), not
+ * just idempotent ones like RMQ.h. Level $k$ stores, for
+ * every block of size $2^{k+1}$, suffix aggregates of its
+ * left half and prefix aggregates of its right half, so
+ * $[a, b)$ is one combine on the level of the highest bit
+ * of $a \oplus (b - 1)$.
+ * Usage:
+ *  DST dst(v, [](int a, int b) { return a + b; });
+ *  dst.query(inclusive, exclusive);
+ * Time: $O(|V| \log |V| + Q)$
+ * Status: stress-tested
+ */
+template<class T, class F> struct DST {
+  vector<vector<T>> t;
+  F f;
+  DST(const vector<T>& v, F f): f(f) {
+    int n = (int)(v).size(), h = 1;
+    while ((1 << h) < n) h++;
+    t.assign(h, v);
+    for (int k = 1; k < (h); k++)
+      for (int m = 1 << k; m < n; m += 2 << k) {
+        for (int i = m - 1; i-- > m - (1 << k);)
+          t[k][i] = f(v[i], t[k][i + 1]);
+        for (int i = m + 1; i < min(n, m + (1 << k)); i++)
+          t[k][i] = f(t[k][i - 1], v[i]);
+      }
+  }
+  T query(int a, int b) {
+    assert(a < b);
+    if (a == --b) return t[0][a];
+    int k = 31 - __builtin_clz(a ^ b);
+    return f(t[k][a], t[k][b]);
+  }
+};
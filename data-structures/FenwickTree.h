@@ -5,30 +5,37 @@
  * Source: folklore/TopCoder
  * Description: Computes partial sums a[0] + a[1] + ... +
  * a[pos - 1], and updates single elements a[i], taking the
- * difference between the old and new value. Time: Both
- * operations are $O(\log N)$. Status: Stress-tested
+ * difference between the old and new value. T can be
+ * narrowed (e.g. int) to halve memory. Building from a
+ * vector is O(N). Time: Both operations are $O(\log N)$.
+ * Status: Stress-tested
  */
-struct FT {
-  vector<int64_t> s;
+template<class T = int64_t> struct FT {
+  vector<T> s;
   FT(int n): s(n) {}
-  void update(int pos, int64_t dif) { // a[pos] += dif
+  FT(const vector<T>& a): s(a) { // O(N) build
+    for (int i = 0; i < ((int)(s).size()); i++)
+      if ((i | (i + 1)) < (int)(s).size())
+        s[i | (i + 1)] += s[i];
+  }
+  void update(int pos, T dif) { // a[pos] += dif
     for (; pos < (int)(s).size(); pos |= pos + 1)
       s[pos] += dif;
   }
-  int64_t query(int pos) { // sum of values in [0, pos)
-    int64_t res = 0;
+  T query(int pos) { // sum of values in [0, pos)
+    T res = 0;
     for (; pos > 0; pos &= pos - 1) res += s[pos - 1];
     return res;
   }
   int lower_bound(
-    int64_t sum) { // min pos st sum of [0, pos] >= sum
+    T sum) { // min pos st sum of [0, pos] >= sum
     // Returns n if no sum is >= sum, or -1 if empty sum
     // is.
     if (sum <= 0) return -1;
-    int pos = 0;
-    for (int pw = 1 << 25; pw; pw >>= 1)
-      if (pos + pw <= (int)(s).size() &&
-        s[pos + pw - 1] < sum)
+    int pos = 0, n = (int)(s).size();
+    for (int pw = 1 << (31 - __builtin_clz(n | 1)); pw;
+         pw >>= 1)
+      if (pos + pw <= n && s[pos + pw - 1] < sum)
         pos += pw, sum -= s[pos - 1];
     return pos;
   }
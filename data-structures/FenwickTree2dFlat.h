@@ -0,0 +1,78 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: FenwickTree2d.h
+ * Description: FenwickTree2d.h with all columns packed
+ * into one array: column x is ys/s[st[x], st[x + 1]). Call
+ * fakeUpdate() for every point first, then init(). For
+ * fully offline use, prep(x, y, forQuery) after init()
+ * stores the inner index of (x, y) on every level that an
+ * update (or query) visits and returns a handle;
+ * update/query on a handle do no binary searches.
+ * Usage: int h = ft.prep(x, y, 0); ft.update(h, 1);
+ * Time: $O(\log^2 N)$. Status: stress-tested
+ */
+struct FT2F {
+  int X;
+  vector<int> st, ys, hx, hs, hi;
+  vector<pair<int, int>> pts;
+  vector<int64_t> s;
+  FT2F(int limx): X(limx), st(limx + 1) {}
+  void fakeUpdate(int x, int y) { pts.push_back({x, y}); }
+  void init() {
+    for (auto [x, y] : pts)
+      for (; x < X; x |= x + 1) st[x + 1]++;
+    partial_sum(begin(st), end(st), begin(st));
+    vector<int> at(begin(st), end(st) - 1);
+    ys.resize(st[X]), s.assign(st[X], 0);
+    for (auto [x, y] : pts)
+      for (; x < X; x |= x + 1) ys[at[x]++] = y;
+    for (int x = 0; x < (X); x++)
+      sort(ys.begin() + st[x], ys.begin() + st[x + 1]);
+    pts.clear(), pts.shrink_to_fit();
+  }
+  int ind(int x, int y) {
+    return int(lower_bound(ys.begin() + st[x],
+                 ys.begin() + st[x + 1], y) -
+      ys.begin());
+  }
+  void add(int x, int i, int64_t dif) { // i is flat
+    int b = st[x], n = st[x + 1] - b;
+    for (i -= b; i < n; i |= i + 1) s[b + i] += dif;
+  }
+  int64_t sum(int x, int i) { // sum of s[st[x], i)
+    int64_t res = 0;
+    for (i -= st[x]; i > 0; i &= i - 1)
+      res += s[st[x] + i - 1];
+    return res;
+  }
+  void update(int x, int y, int64_t dif) {
+    for (; x < X; x |= x + 1) add(x, ind(x, y), dif);
+  }
+  int64_t query(int x, int y) {
+    int64_t res = 0;
+    for (; x; x &= x - 1) res += sum(x - 1, ind(x - 1, y));
+    return res;
+  }
+  int prep(int x, int y, bool forQuery) {
+    hx.push_back(x), hs.push_back((int)(hi).size());
+    if (forQuery)
+      for (; x; x &= x - 1) hi.push_back(ind(x - 1, y));
+    else
+      for (; x < X; x |= x + 1) hi.push_back(ind(x, y));
+    return (int)(hx).size() - 1;
+  }
+  void update(int h, int64_t dif) {
+    int* p = hi.data() + hs[h];
+    for (int x = hx[h]; x < X; x |= x + 1)
+      add(x, *p++, dif);
+  }
+  int64_t query(int h) {
+    int64_t res = 0;
+    int* p = hi.data() + hs[h];
+    for (int x = hx[h]; x; x &= x - 1)
+      res += sum(x - 1, *p++);
+    return res;
+  }
+};
@@ -0,0 +1,75 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: folklore
+ * Description: Range add and range sum on an array,
+ * using two Fenwick arrays for the coefficients of
+ * $pos$ and $1$ in the prefix sum. updateBatch and
+ * queryBatch loop over update() / query(), except that a
+ * batch of more than N/16 updates or N/4 queries goes
+ * through one O(N) pass over the arrays instead (the
+ * measured break-even points).
+ * Usage: RangeFT<int64_t> ft(n); ft.update(l, r, x);
+ *  ft.query(l, r);
+ * Time: O(\log N) per operation, a batch of $K$ is
+ * $O(\min(K \log N, N + K))$.
+ * Status: stress-tested
+ */
+template<class T> struct RangeFT {
+  int n;
+  vector<T> a, b;
+  RangeFT(int n): n(n), a(n), b(n) {}
+  void add(vector<T>& s, int pos, T dif) {
+    for (; pos < n; pos |= pos + 1) s[pos] += dif;
+  }
+  T sum(vector<T>& s, int pos) {
+    T res = 0;
+    for (; pos > 0; pos &= pos - 1) res += s[pos - 1];
+    return res;
+  }
+  void update(int l, int r, T x) { // a[l, r) += x
+    add(a, l, x * l), add(b, l, x);
+    add(a, r, -x * r), add(b, r, -x);
+  }
+  T query(int pos) { // sum of [0, pos)
+    return sum(b, pos) * pos - sum(a, pos);
+  }
+  T query(int l, int r) { return query(r) - query(l); }
+  void updateBatch(const vector<tuple<int, int, T>>& U) {
+    if ((int64_t)(int)(U).size() * 16 > n) {
+      vector<T> da(n + 1), db(n + 1);
+      for (auto& [l, r, x] : U)
+        da[l] += x * l, db[l] += x, da[r] -= x * r,
+          db[r] -= x;
+      for (int i = 0; i < (n); i++)
+        if ((i | (i + 1)) < n)
+          da[i | (i + 1)] += da[i],
+            db[i | (i + 1)] += db[i];
+      for (int i = 0; i < (n); i++)
+        a[i] += da[i], b[i] += db[i];
+      return;
+    }
+    for (auto& [l, r, x] : U) update(l, r, x);
+  }
+  vector<T> queryBatch(const vector<int>& Q) { // prefixes
+    vector<T> res((int)(Q).size());
+    if ((int64_t)(int)(Q).size() * 4 > n) {
+      vector<T> da = a, db = b, pre(n + 1);
+      for (int i = n; i--;)
+        if ((i | (i + 1)) < n)
+          da[i | (i + 1)] -= da[i],
+            db[i | (i + 1)] -= db[i];
+      T sa = 0, sb = 0;
+      for (int i = 0; i < (n); i++)
+        sa += da[i], sb += db[i],
+          pre[i + 1] = sb * (i + 1) - sa;
+      for (int i = 0; i < ((int)(Q).size()); i++)
+        res[i] = pre[Q[i]];
+      return res;
+    }
+    for (int i = 0; i < ((int)(Q).size()); i++)
+      res[i] = query(Q[i]);
+    return res;
+  }
+};
@@ -0,0 +1,139 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: Treap.h
+ * Description: Treap.h as an implicit sequence in one node
+ * array with 32-bit child indices (0 is null) and an
+ * xorshift generator per instance. Supports lazy range
+ * reverse, add and assign with range sum and min. split
+ * and merge are iterative, and build() makes a treap from
+ * a whole array in O(N) with a Cartesian-tree stack.
+ * Roots are plain ints, so one Treap can hold many
+ * sequences.
+ * Usage: Treap t; int r = t.build(v);
+ *  t.update(r, 2, 5, [&](int x) { t.apply(x, 0, 3); });
+ * Time: $O(\log N)$
+ * Status: stress-tested
+ */
+struct Treap {
+  static constexpr int64_t NO = LLONG_MIN;
+  struct N {
+    int l = 0, r = 0, c = 0;
+    uint32_t y = 0;
+    int64_t val = 0, sum = 0, mn = LLONG_MAX, add = 0,
+            set = NO;
+    bool rev = 0;
+  };
+  vector<N> t{N()};
+  vector<int> st;
+  uint32_t seed = 2463534242;
+  uint32_t rnd() {
+    seed ^= seed << 13, seed ^= seed >> 17;
+    return seed ^= seed << 5;
+  }
+  int make(int64_t v) {
+    t.push_back(N());
+    N& n = t.back();
+    n.c = 1, n.y = rnd(), n.val = n.sum = n.mn = v;
+    return (int)(t).size() - 1;
+  }
+  void apply(int x, bool rev, int64_t add,
+    int64_t set = NO) { // set = NO: no assignment
+    if (!x) return;
+    N& n = t[x];
+    n.rev ^= rev;
+    if (set != NO)
+      n.val = n.mn = n.set = set, n.sum = set * n.c,
+      n.add = 0;
+    if (add) {
+      n.val += add, n.mn += add, n.sum += add * n.c;
+      if (n.set != NO) n.set += add;
+      else n.add += add;
+    }
+  }
+  void push(int x) {
+    N& n = t[x];
+    if (!n.rev && !n.add && n.set == NO) return;
+    if (n.rev) swap(n.l, n.r);
+    for (int y : {n.l, n.r}) apply(y, n.rev, n.add, n.set);
+    n.rev = 0, n.add = 0, n.set = NO;
+  }
+  void pull(int x) {
+    N &n = t[x], &a = t[n.l], &b = t[n.r];
+    n.c = a.c + b.c + 1, n.sum = a.sum + b.sum + n.val;
+    n.mn = min({a.mn, b.mn, n.val});
+  }
+  void pullPath() {
+    for (; !st.empty(); st.pop_back()) pull(st.back());
+  }
+  pair<int, int> split(int x, int k) { // [0, k), [k, n)
+    int a = 0, b = 0, *pa = &a, *pb = &b;
+    while (x) {
+      push(x), st.push_back(x);
+      if (t[t[x].l].c >= k) *pb = x, pb = &t[x].l, x = *pb;
+      else {
+        k -= t[t[x].l].c + 1;
+        *pa = x, pa = &t[x].r, x = *pa;
+      }
+    }
+    *pa = *pb = 0;
+    pullPath();
+    return {a, b};
+  }
+  int merge(int a, int b) {
+    int res = 0, *p = &res;
+    while (a && b) {
+      if (t[a].y > t[b].y)
+        push(a), st.push_back(*p = a), p = &t[a].r, a = *p;
+      else
+        push(b), st.push_back(*p = b), p = &t[b].l, b = *p;
+    }
+    *p = a ? a : b;
+    pullPath();
+    return res;
+  }
+  int build(const vector<int64_t>& v) {
+    vector<int> s;
+    for (int64_t x : v) {
+      int n = make(x), last = 0;
+      while ((int)(s).size() && t[s.back()].y < t[n].y)
+        last = s.back(), s.pop_back();
+      t[n].l = last;
+      if ((int)(s).size()) t[s.back()].r = n;
+      s.push_back(n);
+    }
+    if (s.empty()) return 0;
+    st = {s[0]};
+    for (int i = 0; i < ((int)(st).size()); i++)
+      for (int y : {t[st[i]].l, t[st[i]].r})
+        if (y) st.push_back(y);
+    pullPath();
+    return s[0];
+  }
+  // Calls f on the root of the subtree holding [l, r).
+  template<class F>
+  void update(int& root, int l, int r, F f) {
+    auto [a, b] = split(root, l);
+    auto [m, c] = split(b, r - l);
+    f(m);
+    root = merge(merge(a, m), c);
+  }
+  void ins(int& root, int pos, int64_t v) {
+    auto [a, b] = split(root, pos);
+    root = merge(merge(a, make(v)), b);
+  }
+  // Example application: move the range [l, r) to index k
+  void move(int& root, int l, int r, int k) {
+    auto [a, b] = split(root, l);
+    auto [m, c] = split(b, r - l);
+    root = merge(a, c);
+    if (k > l) k -= r - l;
+    auto [x, y] = split(root, k);
+    root = merge(merge(x, m), y);
+  }
+  template<class F> void each(int x, F f) {
+    if (!x) return;
+    push(x), each(t[x].l, f), f(t[x].val), each(t[x].r, f);
+  }
+};
@@ -0,0 +1,83 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://codeforces.com/blog/entry/18051, AtCoder
+ * Library
+ * Description: Non-recursive lazy segment tree over one
+ * array of $2^{\lceil \log N \rceil + 1}$ values and tags,
+ * no pointers. S gives the value monoid (T, unit, f), the
+ * tag monoid (L, id, comp) and apply; here range add and
+ * range max. comp(x, y) is tag y followed by x, and
+ * apply(id, a) must be a. Tags are pushed top-down along
+ * the two boundary paths of each operation. Bounds are
+ * inclusive to the left and exclusive to the right.
+ * Usage: LazyTree<MaxAdd> t(v); t.update(l, r, x);
+ * Time: O(\log N).
+ * Status: stress-tested
+ */
+struct MaxAdd {
+  typedef int T;
+  typedef int L;
+  static constexpr T unit = INT_MIN;
+  static constexpr L id = 0;
+  static T f(T a, T b) { return max(a, b); }
+  static T apply(L x, T a) { return a + x; }
+  static L comp(L x, L y) { return x + y; }
+};
+template<class S> struct LazyTree {
+  typedef typename S::T T;
+  typedef typename S::L L;
+  int n = 1, h = 0;
+  vector<T> d;
+  vector<L> lz;
+  LazyTree(const vector<T>& v) {
+    while (n < (int)(v).size()) n *= 2, h++;
+    d.assign(2 * n, S::unit), lz.assign(n, S::id);
+    copy(begin(v), end(v), d.begin() + n);
+    for (int i = n; --i > 0;) pull(i);
+  }
+  void pull(int i) { d[i] = S::f(d[2 * i], d[2 * i + 1]); }
+  void app(int i, L x) {
+    d[i] = S::apply(x, d[i]);
+    if (i < n) lz[i] = S::comp(x, lz[i]);
+  }
+  void push(int i) {
+    app(2 * i, lz[i]), app(2 * i + 1, lz[i]);
+    lz[i] = S::id;
+  }
+  void pushPath(int b, int e) {
+    for (int k = h; k > 0; k--) {
+      if ((b >> k << k) != b) push(b >> k);
+      if ((e >> k << k) != e) push((e - 1) >> k);
+    }
+  }
+  void set(int pos, T val) {
+    pos += n;
+    for (int k = h; k > 0; k--) push(pos >> k);
+    d[pos] = val;
+    for (int k = 1; k < (h + 1); k++) pull(pos >> k);
+  }
+  T query(int b, int e) { // query [b, e)
+    T ra = S::unit, rb = S::unit;
+    if (b == e) return ra;
+    pushPath(b += n, e += n);
+    for (; b < e; b /= 2, e /= 2) {
+      if (b % 2) ra = S::f(ra, d[b++]);
+      if (e % 2) rb = S::f(d[--e], rb);
+    }
+    return S::f(ra, rb);
+  }
+  void update(int b, int e, L x) { // apply x to [b, e)
+    if (b == e) return;
+    pushPath(b += n, e += n);
+    for (int l = b, r = e; l < r; l /= 2, r /= 2) {
+      if (l % 2) app(l++, x);
+      if (r % 2) app(--r, x);
+    }
+    for (int k = 1; k < (h + 1); k++) {
+      if ((b >> k << k) != b) pull(b >> k);
+      if ((e >> k << k) != e) pull((e - 1) >> k);
+    }
+  }
+};
@@ -0,0 +1,72 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://cp-algorithms.com/geometry/convex_hull_trick.html
+ * Description: Maximum of lines $kx+m$ at points from a
+ * fixed set xs, given up front. The tree is one array of
+ * lines in heap order over the sorted points; each node
+ * keeps the line that wins at its middle point, so adding
+ * a line pushes the loser down one path. add(k, m, l, r)
+ * adds a segment that only exists for $l \le x < r$.
+ * Queries must be points of xs.
+ * Usage: LiChao lc(xs); lc.add(2, 3); lc.query(xs[0]);
+ * Time: $O(\log N)$, $O(\log^2 N)$ for segments.
+ * Status: stress-tested
+ */
+struct LiChao {
+  static const int64_t inf = LLONG_MAX;
+  struct Line {
+    int64_t k = 0, m = -inf;
+    int64_t operator()(int64_t x) const {
+      return k * x + m;
+    }
+  };
+  int N = 1;
+  vector<int64_t> xs;
+  vector<Line> t;
+  LiChao(vector<int64_t> x): xs(x) {
+    sort(begin(xs), end(xs));
+    xs.erase(unique(begin(xs), end(xs)), end(xs));
+    while (N < (int)(xs).size()) N *= 2;
+    xs.resize(N, xs.empty() ? 0 : xs.back());
+    t.resize(2 * N);
+  }
+  void ins(Line ln, int i) { // into the subtree of node i
+    int lo = i, hi = i + 1;
+    for (; lo < N; lo *= 2) hi *= 2;
+    lo -= N, hi -= N;
+    for (;;) {
+      int m = (lo + hi) / 2;
+      bool l = ln(xs[lo]) > t[i](xs[lo]),
+           c = ln(xs[m]) > t[i](xs[m]),
+           r = ln(xs[hi - 1]) > t[i](xs[hi - 1]);
+      if (c) swap(ln, t[i]), l = !l, r = !r;
+      if (i >= N || (!l && !r)) return;
+      if (l) i = 2 * i, hi = m;
+      else i = 2 * i + 1, lo = m;
+    }
+  }
+  void add(int64_t k, int64_t m) { ins({k, m}, 1); }
+  void add(int64_t k, int64_t m, int64_t l, int64_t r) {
+    auto ind = [&](int64_t x) {
+      return int(lower_bound(begin(xs), end(xs), x) -
+        begin(xs));
+    };
+    for (int a = ind(l) + N, b = ind(r) + N; a < b;
+         a /= 2, b /= 2) {
+      if (a & 1) ins({k, m}, a++);
+      if (b & 1) ins({k, m}, --b);
+    }
+  }
+  int64_t query(int64_t x) { // -inf if no line covers x
+    int64_t res = -inf;
+    for (int i = 1, lo = 0, hi = N;;) {
+      res = max(res, t[i](x));
+      if (i >= N) return res;
+      int m = (lo + hi) / 2;
+      if (x < xs[m]) i = 2 * i, hi = m;
+      else i = 2 * i + 1, lo = m;
+    }
+  }
+};
@@ -0,0 +1,62 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://codeforces.com/blog/entry/78931
+ * Description: RMQ.h in $O(N)$ memory. The array is cut
+ * into blocks of 64; a sparse table over the block minima
+ * answers the middle part of a query, and each position
+ * $i$ stores a 64-bit mask of the monotonic stack of its
+ * block after pushing $i$, so the minimum of $[l, i]$
+ * inside one block is the lowest stack bit at or above
+ * $l$.
+ * Uses about $2N$ words. C is the comparator.
+ * Usage:
+ *  LinearRMQ<int> rmq(values);
+ *  rmq.query(inclusive, exclusive);
+ * Time: $O(|V| + Q)$
+ * Status: stress-tested
+ */
+template<class T, class C = less<T>> struct LinearRMQ {
+  vector<T> v;
+  vector<uint64_t> m;
+  vector<vector<T>> jmp;
+  C cmp;
+  T mn(T a, T b) { return cmp(b, a) ? b : a; }
+  LinearRMQ(const vector<T>& V): v(V), m((int)(V).size()) {
+    uint64_t st = 0;
+    for (int i = 0; i < ((int)(V).size()); i++) {
+      if (i % 64 == 0) st = 0;
+      while (st &&
+        cmp(V[i], V[(i & ~63) + 63 - __builtin_clzll(st)]))
+        st ^= 1ULL << (63 - __builtin_clzll(st));
+      m[i] = st |= 1ULL << (i % 64);
+    }
+    jmp.emplace_back();
+    for (int i = 0; i < (int)(V).size(); i += 64)
+      jmp[0].push_back(
+        inBlock(i, min(i + 63, (int)(V).size() - 1)));
+    int B = (int)(jmp[0]).size();
+    for (int pw = 1, k = 1; pw * 2 <= B; pw *= 2, ++k) {
+      jmp.emplace_back(B - pw * 2 + 1);
+      for (int j = 0; j < ((int)(jmp[k]).size()); j++)
+        jmp[k][j] = mn(jmp[k - 1][j], jmp[k - 1][j + pw]);
+    }
+  }
+  T inBlock(int l, int r) { // [l, r] in one block
+    return v[(r & ~63) +
+      __builtin_ctzll(m[r] >> (l % 64) << (l % 64))];
+  }
+  T query(int a, int b) {
+    assert(a < b); // or return inf if a == b
+    int r = b - 1, x = a / 64 + 1, y = r / 64;
+    if (x > y) return inBlock(a, r);
+    T res = mn(inBlock(a, x * 64 - 1), inBlock(y * 64, r));
+    if (x < y) {
+      int dep = 31 - __builtin_clz(y - x);
+      res =
+        mn(res, mn(jmp[dep][x], jmp[dep][y - (1 << dep)]));
+    }
+    return res;
+  }
+};
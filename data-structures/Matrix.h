@@ -16,8 +16,8 @@ template<class T, int N> struct Matrix {
   M operator*(const M& m) const {
     M a;
     for (int i = 0; i < (N); i++)
-      for (int j = 0; j < (N); j++)
-        for (int k = 0; k < (N); k++)
+      for (int k = 0; k < (N); k++)
+        for (int j = 0; j < (N); j++)
           a.d[i][j] += d[i][k] * m.d[k][j];
     return a;
   }
@@ -0,0 +1,66 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: Matrix.h
+ * Description: Matrix.h for runtime sizes and entries
+ * modulo mod $< 2^{30}$. Rows are multiplied into 64-bit
+ * accumulators in i-k-j order (which the compiler
+ * vectorizes), and reduced only once every 16 values of k,
+ * since $16 \cdot mod^2 + mod < 2^{64}$.
+ * Usage: ModMatrix A(n); A[0][1] = 5;
+ *  vector<uint32_t> vec = (A ^ p) * vec;
+ * Time: $O(N^3 \log p)$ for A ^ p.
+ * Status: stress-tested
+ */
+const int64_t mod = 1000000007; // faster if const
+struct ModMatrix {
+  typedef ModMatrix M;
+  int n;
+  vector<uint32_t> d;
+  ModMatrix(int n): n(n), d(n * n) {}
+  uint32_t* operator[](int i) { return &d[i * n]; }
+  const uint32_t* operator[](int i) const {
+    return &d[i * n];
+  }
+  M operator*(const M& m) const {
+    M a(n);
+    vector<uint64_t> acc(n);
+    for (int i = 0; i < (n); i++) {
+      fill(begin(acc), end(acc), 0);
+      for (int k = 0; k < (n); k++) {
+        uint64_t x = (*this)[i][k];
+        const uint32_t* r = m[k];
+        for (int j = 0; j < (n); j++) acc[j] += x * r[j];
+        if (k % 16 == 15)
+          for (auto& y : acc) y %= mod;
+      }
+      for (int j = 0; j < (n); j++) a[i][j] = acc[j] % mod;
+    }
+    return a;
+  }
+  vector<uint32_t> operator*(
+    const vector<uint32_t>& vec) const {
+    vector<uint32_t> ret(n);
+    for (int i = 0; i < (n); i++) {
+      uint64_t s = 0;
+      for (int j = 0; j < (n); j++) {
+        s += uint64_t((*this)[i][j]) * vec[j];
+        if (j % 16 == 15) s %= mod;
+      }
+      ret[i] = s % mod;
+    }
+    return ret;
+  }
+  M operator^(int64_t p) const {
+    assert(p >= 0);
+    M a(n), b(*this);
+    for (int i = 0; i < (n); i++) a[i][i] = 1;
+    while (p) {
+      if (p & 1) a = a * b;
+      b = b * b;
+      p >>= 1;
+    }
+    return a;
+  }
+};
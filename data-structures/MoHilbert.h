@@ -0,0 +1,75 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://codeforces.com/blog/entry/61203
+ * Description: MoQueries.h with queries sorted by the
+ * index of $(L, R)$ on a Hilbert curve. This needs no
+ * block size; on random queries it moves the pointers
+ * about 5\% more than mo() with its tuned block size. The
+ * state is an object S with add(ind, end),
+ * del(ind, end) and calc() as in MoQueries.h, so several
+ * instances can coexist. run(s, K) cuts the sorted order
+ * into K contiguous chunks and answers each one on its own
+ * thread with its own copy of s (so S must be copyable
+ * into an independent empty state, and calc() must not
+ * return bool).
+ * Usage: Mo<State> mo(Q);
+ *  vector<int> res = mo.run(State(a), 8);
+ * Time: O(N \sqrt Q)
+ * Status: stress-tested
+ */
+int64_t hilbert(int x, int y, int lg) {
+  int64_t d = 0;
+  for (int s = 1 << lg >> 1; s; s >>= 1) {
+    bool rx = x & s, ry = y & s;
+    d = d << 2 | (rx * 3 ^ ry);
+    if (!ry) {
+      if (rx) x = ~x, y = ~y;
+      swap(x, y);
+    }
+  }
+  return d;
+}
+template<class S> struct Mo {
+  typedef decltype(declval<S>().calc()) T;
+  vector<pair<int, int>> Q;
+  vector<int> s;
+  Mo(const vector<pair<int, int>>& q):
+    Q(q), s((int)(q).size()) {
+    int lg = 1;
+    for (auto [l, r] : Q)
+      while (r >> lg) lg++;
+    vector<int64_t> h((int)(Q).size());
+    for (int i = 0; i < ((int)(Q).size()); i++)
+      h[i] = hilbert(Q[i].first, Q[i].second, lg);
+    iota(begin(s), end(s), 0);
+    sort(begin(s), end(s),
+      [&](int a, int b) { return h[a] < h[b]; });
+  }
+  void go(S& st, int b, int e, vector<T>& res) {
+    int L = 0, R = 0;
+    for (int i = b; i < e; i++) {
+      auto [l, r] = Q[s[i]];
+      while (L > l) st.add(--L, 0);
+      while (R < r) st.add(R++, 1);
+      while (L < l) st.del(L++, 0);
+      while (R > r) st.del(--R, 1);
+      res[s[i]] = st.calc();
+    }
+  }
+  vector<T> run(S st, int K = 1) {
+    int n = (int)(Q).size();
+    vector<T> res(n);
+    if (K == 1) return go(st, 0, n, res), res;
+    vector<S> sts(K, st);
+    vector<thread> th;
+    for (int k = 0; k < (K); k++)
+      th.emplace_back([&, k] {
+        go(sts[k], int(int64_t(n) * k / K),
+          int(int64_t(n) * (k + 1) / K), res);
+      });
+    for (auto& t : th) t.join();
+    return res;
+  }
+};
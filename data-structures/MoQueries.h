@@ -10,6 +10,11 @@
  * points at the ends. If values are on tree edges, change
  * \texttt{step} to add/remove the edge $(a, c)$ and remove
  * the initial \texttt{add} call (but keep \texttt{in}).
+ * moUpd also takes point updates: query $i$ sees the
+ * first Q[i][2] of T updates, and \texttt{upd} toggles one
+ * (swaps the stored value with the array, doing del/add if
+ * the position is in $[L, R)$). Time $O(N^{5/3})$ for
+ * $N \approx Q \approx T$.
  * Time: O(N \sqrt Q)
  * Status: stress-tested
  */
@@ -18,8 +23,11 @@ void add(int ind, int end) {
 } // add a[ind] (end = 0 or 1)
 void del(int ind, int end) { ... } // remove a[ind]
 int calc(){...} // compute current answer
+void upd(int t, int L, int R) { ... } // toggle update t
 vector<int> mo(vector<pair<int, int>> Q) {
-  int L = 0, R = 0, blk = 350; // ~N/sqrt(Q)
+  int L = 0, R = 0, N = 1;
+  for (auto [l, r] : Q) N = max(N, r);
+  int blk = max(1.0, N / sqrt((int)(Q).size() + 1));
   vector<int> s((int)(Q).size()), res = s;
   iota(begin(s), end(s), 0);
   sort(begin(s), end(s), [&](int s, int t) {
@@ -38,10 +46,34 @@ vector<int> mo(vector<pair<int, int>> Q) {
   }
   return res;
 }
+vector<int> moUpd(vector<array<int, 3>> Q, int N, int T) {
+  int L = 0, R = 0, t = 0, q = (int)(Q).size() + 1;
+  int blk = max(cbrt(1.0 * N * N * T / q), N / sqrt(q));
+  blk = max(blk, 1);
+  vector<int> s((int)(Q).size()), res = s;
+  iota(begin(s), end(s), 0);
+  auto key = [&](array<int, 3>& x) {
+    int a = x[0] / blk, b = x[1] / blk ^ -(a & 1);
+    return array<int, 3>{a, b, x[2] ^ -(b & 1)};
+  };
+  sort(begin(s), end(s),
+    [&](int s, int t) { return key(Q[s]) < key(Q[t]); });
+  for (int qi : s) {
+    auto [l, r, u] = Q[qi];
+    while (t < u) upd(t++, L, R);
+    while (t > u) upd(--t, L, R);
+    while (L > l) add(--L, 0);
+    while (R < r) add(R++, 1);
+    while (L < l) del(L++, 0);
+    while (R > r) del(--R, 1);
+    res[qi] = calc();
+  }
+  return res;
+}
 vector<int> moTree(vector<array<int, 2>> Q,
   vector<vector<int>>& ed, int root = 0) {
   int N = (int)(ed).size(), pos[2] = {},
-      blk = 350; // ~N/sqrt(Q)
+      blk = max(1.0, 2 * N / sqrt((int)(Q).size() + 1));
   vector<int> s((int)(Q).size()), res = s, I(N), L(N),
                                   R(N), in(N), par(N);
   add(0, 0), in[0] = 1;
@@ -0,0 +1,45 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: LineContainer.h
+ * Description: LineContainer.h for when lines come in
+ * order of non-decreasing slope and queries in order of
+ * non-decreasing x: the hull is a vector used as a deque,
+ * with a head index that only moves forward. For minimum,
+ * negate k, m and the result.
+ * Usage: MonoCHT h; h.add(1, 5); h.add(2, 0); h.query(3);
+ * Time: amortized O(1)
+ * Status: stress-tested
+ */
+struct MonoCHT {
+  vector<pair<int64_t, int64_t>> h; // (k, m)
+  int hd = 0;
+  bool bad(pair<int64_t, int64_t> a,
+    pair<int64_t, int64_t> b, pair<int64_t, int64_t> c) {
+    return (__int128)(a.second - c.second) *
+      (b.first - a.first) <=
+      (__int128)(a.second - b.second) *
+      (c.first - a.first);
+  }
+  void add(int64_t k, int64_t m) {
+    int s = (int)(h).size();
+    if (s > hd && h[s - 1].first == k) {
+      if (h[s - 1].second >= m) return;
+      h.pop_back(), s--;
+    }
+    while (s - hd >= 2 && bad(h[s - 2], h[s - 1], {k, m}))
+      h.pop_back(), s--;
+    h.push_back({k, m});
+  }
+  int64_t eval(int i, int64_t x) {
+    return h[i].first * x + h[i].second;
+  }
+  int64_t query(int64_t x) {
+    assert(hd < (int)(h).size());
+    while (hd + 1 < (int)(h).size() &&
+      eval(hd + 1, x) >= eval(hd, x))
+      hd++;
+    return eval(hd, x);
+  }
+};
@@ -0,0 +1,182 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: OrderStatisticTree.h
+ * Description: OrderStatisticTree.h without pb\_ds: a set
+ * (not multiset!) stored as a B+-tree with up to B keys
+ * per node. Leaves hold sorted keys; inner nodes hold, per
+ * child, its index, largest key and number of keys. Nodes
+ * are never merged, only freed once empty. build() bulk
+ * loads sorted distinct keys into 3/4 full nodes. Uses
+ * about 6 bytes per int key versus about 40 for pb\_ds.
+ * Usage: BTree<int> t; t.insert(8); t.order_of_key(10);
+ *  t.find_by_order(0); t.erase(8);
+ * Time: $O(B \log_B N)$, with $O(\log_B N)$ cache misses.
+ * Status: stress-tested
+ */
+template<class T, int B = 64> struct BTree {
+  struct Leaf {
+    int n = 0;
+    T k[B];
+  };
+  struct Inner {
+    int n = 0;
+    T mx[B];
+    int ch[B], c[B];
+  };
+  vector<Leaf> lf{Leaf()};
+  vector<Inner> in;
+  vector<int> fl, fi; // free leaves, free inner nodes
+  int root = 0, h = 0, cnt = 0;
+  bool done;
+  int size() { return cnt; }
+  template<class V> int get(vector<V>& p, vector<int>& f) {
+    if (f.empty())
+      return p.emplace_back(), (int)(p).size() - 1;
+    int x = f.back();
+    f.pop_back(), p[x].n = 0;
+    return x;
+  }
+  int rank(const T* a, int n, const T& x) { // # a[i] < x
+    int r = 0;
+    for (int i = 0; i < (n); i++) r += a[i] < x;
+    return r;
+  }
+  T mxOf(int v, int d) {
+    if (!d) return lf[v].k[lf[v].n - 1];
+    return in[v].mx[in[v].n - 1];
+  }
+  int cntOf(int v, int d) {
+    if (!d) return lf[v].n;
+    return accumulate(in[v].c, in[v].c + in[v].n, 0);
+  }
+  void put(int v, int i, int w, int d) {
+    Inner& p = in[v];
+    p.ch[i] = w, p.mx[i] = mxOf(w, d);
+    p.c[i] = cntOf(w, d);
+  }
+  int ins(int v, int d, const T& x) { // new right sibling
+    if (!d) {
+      Leaf& l = lf[v];
+      int i = rank(l.k, l.n, x);
+      if (i < l.n && !(x < l.k[i])) return done = 0, -1;
+      copy_backward(l.k + i, l.k + l.n, l.k + l.n + 1);
+      l.k[i] = x;
+      if (++l.n < B) return -1;
+      int w = get(lf, fl);
+      Leaf &a = lf[v], &b = lf[w];
+      a.n = B - B / 2, b.n = B / 2;
+      copy(a.k + a.n, a.k + B, b.k);
+      return w;
+    }
+    int i = min(rank(in[v].mx, in[v].n, x), in[v].n - 1);
+    int w = ins(in[v].ch[i], d - 1, x);
+    Inner& p = in[v];
+    if (!done) return -1;
+    if (w < 0) {
+      p.c[i]++;
+      if (p.mx[i] < x) p.mx[i] = x;
+      return -1;
+    }
+    for (int j = p.n; j > i + 1; j--)
+      p.ch[j] = p.ch[j - 1], p.mx[j] = p.mx[j - 1],
+      p.c[j] = p.c[j - 1];
+    p.n++, put(v, i, p.ch[i], d - 1);
+    put(v, i + 1, w, d - 1);
+    if (p.n < B) return -1;
+    w = get(in, fi);
+    Inner &a = in[v], &b = in[w];
+    a.n = B - B / 2, b.n = B / 2;
+    copy(a.ch + a.n, a.ch + B, b.ch);
+    copy(a.mx + a.n, a.mx + B, b.mx);
+    copy(a.c + a.n, a.c + B, b.c);
+    return w;
+  }
+  bool insert(const T& x) {
+    done = 1;
+    int w = ins(root, h, x);
+    if (!done) return 0;
+    cnt++;
+    if (w >= 0) {
+      int r = get(in, fi);
+      in[r].n = 2, put(r, 0, root, h), put(r, 1, w, h);
+      root = r, h++;
+    }
+    return 1;
+  }
+  bool era(int v, int d, const T& x) { // v now empty?
+    if (!d) {
+      Leaf& l = lf[v];
+      int i = rank(l.k, l.n, x);
+      if (i == l.n || x < l.k[i]) return done = 0;
+      copy(l.k + i + 1, l.k + l.n, l.k + i);
+      return !--l.n;
+    }
+    Inner& p = in[v];
+    int i = rank(p.mx, p.n, x);
+    if (i == p.n) return done = 0;
+    if (!era(p.ch[i], d - 1, x)) {
+      if (done) p.c[i]--, p.mx[i] = mxOf(p.ch[i], d - 1);
+      return 0;
+    }
+    (d > 1 ? fi : fl).push_back(p.ch[i]);
+    for (int j = i; j < p.n - 1; j++)
+      p.ch[j] = p.ch[j + 1], p.mx[j] = p.mx[j + 1],
+      p.c[j] = p.c[j + 1];
+    return !--p.n;
+  }
+  bool erase(const T& x) {
+    done = 1;
+    if (era(root, h, x) && h)
+      fi.push_back(root), root = get(lf, fl), h = 0;
+    for (; h && in[root].n == 1; h--)
+      fi.push_back(root), root = in[root].ch[0];
+    return done && cnt--;
+  }
+  int order_of_key(const T& x) { // # of keys < x
+    int r = 0, v = root;
+    for (int d = h; d; d--) {
+      Inner& p = in[v];
+      int i = rank(p.mx, p.n, x);
+      r += accumulate(p.c, p.c + i, 0);
+      if (i == p.n) return r;
+      v = p.ch[i];
+    }
+    return r + rank(lf[v].k, lf[v].n, x);
+  }
+  T find_by_order(int k) { // 0-indexed, k < size()
+    int v = root;
+    for (int d = h; d; d--) {
+      Inner& p = in[v];
+      int i = 0;
+      while (k >= p.c[i]) k -= p.c[i++];
+      v = p.ch[i];
+    }
+    return lf[v].k[k];
+  }
+  void build(const vector<T>& v) { // sorted, distinct
+    *this = BTree();
+    lf.clear();
+    int f = B * 3 / 4;
+    vector<int> cur, nxt;
+    for (int i = 0; i < (int)(v).size() || cur.empty();
+         i += f) {
+      Leaf& l = lf.emplace_back();
+      l.n = min(f, (int)(v).size() - i);
+      copy(v.begin() + i, v.begin() + i + l.n, l.k);
+      cur.push_back((int)(lf).size() - 1);
+    }
+    for (; (int)(cur).size() > 1; h++, swap(cur, nxt)) {
+      nxt.clear();
+      for (int i = 0; i < (int)(cur).size(); i += f) {
+        int r = get(in, fi);
+        in[r].n = min(f, (int)(cur).size() - i);
+        for (int j = 0; j < (in[r].n); j++)
+          put(r, j, cur[i + j], h);
+        nxt.push_back(r);
+      }
+    }
+    root = cur[0], cnt = (int)(v).size();
+  }
+};
@@ -0,0 +1,88 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: LazySegmentTree.h
+ * Description: Persistent version of LazySegmentTree.h
+ * over the interval [lo, hi). set and add copy only the
+ * nodes on their paths and return a new root; all old
+ * roots stay valid. Nodes live in one vector indexed by
+ * int, and node 0 is a shared large interval of -inf, so
+ * children are still created lazily. Queries do not push
+ * and allocate nothing. rollback(t) frees every node made
+ * after t = time(), i.e. drops all later versions.
+ * Usage: PST st(0, n); int r0 = st.build(v, 0, n);
+ *  int r1 = st.add(r0, l, r, x); st.query(r0, l, r);
+ * Time: O(\log N), and O(\log N) new memory per update.
+ * Status: stress-tested
+ */
+const int inf = 1e9;
+struct PST {
+  struct N {
+    int l = 0, r = 0, mset = inf, madd = 0, val = -inf;
+  };
+  vector<N> t{N()};
+  int lo, hi;
+  PST(int lo, int hi): lo(lo), hi(hi) {}
+  int time() { return (int)(t).size(); }
+  void rollback(int tm) { t.resize(tm); }
+  int cp(int x) {
+    t.push_back(t[x]);
+    return (int)(t).size() - 1;
+  }
+  int build(vector<int>& v, int lo, int hi) {
+    int x = cp(0);
+    if (lo + 1 < hi) {
+      int mid = lo + (hi - lo) / 2;
+      t[x].l = build(v, lo, mid);
+      t[x].r = build(v, mid, hi);
+      t[x].val = max(t[t[x].l].val, t[t[x].r].val);
+    } else t[x].val = v[lo];
+    return x;
+  }
+  int query(int x, int L, int R) {
+    return L < R ? query(x, lo, hi, L, R) : -inf;
+  }
+  int query(int x, int lo, int hi, int L, int R) {
+    if (R <= lo || hi <= L) return -inf;
+    if (L <= lo && hi <= R) return t[x].val;
+    if (t[x].mset != inf) return t[x].mset;
+    int mid = lo + (hi - lo) / 2;
+    return t[x].madd +
+      max(query(t[x].l, lo, mid, L, R),
+        query(t[x].r, mid, hi, L, R));
+  }
+  int set(int x, int L, int R, int v) {
+    return upd(x, lo, hi, L, R, 1, v);
+  }
+  int add(int x, int L, int R, int v) {
+    return upd(x, lo, hi, L, R, 0, v);
+  }
+  int tag(int x, bool isSet, int v) { // on a copy of x
+    x = cp(x);
+    if (isSet) t[x].mset = t[x].val = v, t[x].madd = 0;
+    else {
+      if (t[x].mset != inf) t[x].mset += v;
+      else t[x].madd += v;
+      t[x].val += v;
+    }
+    return x;
+  }
+  int upd(int x, int lo, int hi, int L, int R, bool isSet,
+    int v) {
+    if (R <= lo || hi <= L) return x;
+    if (L <= lo && hi <= R) return tag(x, isSet, v);
+    x = cp(x);
+    if (t[x].mset != inf)
+      t[x].l = tag(t[x].l, 1, t[x].mset),
+      t[x].r = tag(t[x].r, 1, t[x].mset), t[x].mset = inf;
+    else if (t[x].madd)
+      t[x].l = tag(t[x].l, 0, t[x].madd),
+      t[x].r = tag(t[x].r, 0, t[x].madd), t[x].madd = 0;
+    int mid = lo + (hi - lo) / 2;
+    t[x].l = upd(t[x].l, lo, mid, L, R, isSet, v);
+    t[x].r = upd(t[x].r, mid, hi, L, R, isSet, v);
+    t[x].val = max(t[t[x].l].val, t[t[x].r].val);
+    return x;
+  }
+};
@@ -0,0 +1,89 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: Treap.h
+ * Description: Treap.h with copy-on-write nodes, so any
+ * number of versions can be read at once. Nodes are
+ * reference counted: split, merge and ins consume the
+ * roots they are given and return owned roots, and a node
+ * is copied only if someone else still refers to it
+ * (otherwise it is changed in place). To keep a version,
+ * pass share(root) instead of root; release(root) drops a
+ * version and recycles every node no other version uses.
+ * Usage: int v1 = pt.ins(pt.share(v0), 3, x);
+ *  pt.release(v0); // v1 is unaffected
+ * Time: $O(\log N)$, and $O(\log N)$ new nodes per
+ * operation on a shared version.
+ * Status: stress-tested
+ */
+struct PTreap {
+  struct N {
+    int l = 0, r = 0, c = 0, ref = 0;
+    uint32_t y = 0;
+    int val = 0;
+  };
+  vector<N> t{N()};
+  vector<int> fr;
+  uint32_t seed = 2463534242;
+  uint32_t rnd() {
+    seed ^= seed << 13, seed ^= seed >> 17;
+    return seed ^= seed << 5;
+  }
+  int alloc(N n) {
+    n.ref = 1;
+    if (fr.empty())
+      return t.push_back(n), (int)(t).size() - 1;
+    int x = fr.back();
+    fr.pop_back(), t[x] = n;
+    return x;
+  }
+  int make(int val) {
+    return alloc({0, 0, 1, 1, rnd(), val});
+  }
+  int cnt(int x) { return t[x].c; }
+  void recalc(int x) {
+    t[x].c = cnt(t[x].l) + cnt(t[x].r) + 1;
+  }
+  int share(int x) { return t[x].ref += !!x, x; }
+  void release(int x) {
+    if (!x || --t[x].ref) return;
+    fr.push_back(x), release(t[x].l), release(t[x].r);
+  }
+  int mut(int x) { // x is owned; returns a private copy
+    if (t[x].ref == 1) return x;
+    t[x].ref--, share(t[x].l), share(t[x].r);
+    return alloc(t[x]);
+  }
+  pair<int, int> split(int x, int k) {
+    if (!x) return {};
+    x = mut(x);
+    if (cnt(t[x].l) >= k) {
+      auto [a, b] = split(t[x].l, k);
+      t[x].l = b, recalc(x);
+      return {a, x};
+    }
+    auto [a, b] = split(t[x].r, k - cnt(t[x].l) - 1);
+    t[x].r = a, recalc(x);
+    return {x, b};
+  }
+  int merge(int a, int b) {
+    if (!a) return b;
+    if (!b) return a;
+    if (t[a].y > t[b].y) {
+      a = mut(a);
+      t[a].r = merge(t[a].r, b);
+      return recalc(a), a;
+    }
+    b = mut(b);
+    t[b].l = merge(a, t[b].l);
+    return recalc(b), b;
+  }
+  int ins(int x, int pos, int val) {
+    auto [a, b] = split(x, pos);
+    return merge(merge(a, make(val)), b);
+  }
+  template<class F> void each(int x, F f) {
+    if (x) each(t[x].l, f), f(t[x].val), each(t[x].r, f);
+  }
+};
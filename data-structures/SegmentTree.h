@@ -3,20 +3,33 @@
  * Date: 2017-10-31
  * License: CC0
  * Source: folklore
- * Description: Zero-indexed max-tree. Bounds are inclusive
- * to the left and exclusive to the right. Can be changed
- * by modifying T, f and unit. Time: O(\log N) Status:
- * stress-tested
+ * Description: Zero-indexed tree over a monoid M (here
+ * max). Bounds are inclusive to the left and exclusive to
+ * the right. Can be changed by modifying T, f and unit
+ * in M. Building from a vector is O(N).
+ * Usage: Tree<> t(v); t.query(l, r);
+ * Time: O(\log N) Status: stress-tested
  */
-struct Tree {
+struct MaxOp {
   typedef int T;
   static constexpr T unit = INT_MIN;
-  T f(T a, T b) {
+  static T f(T a, T b) {
     return max(a, b);
   } // (any associative fn)
+};
+template<class M = MaxOp> struct Tree {
+  typedef typename M::T T;
+  static constexpr T unit = M::unit;
+  T f(T a, T b) { return M::f(a, b); }
   vector<T> s;
   int n;
   Tree(int n = 0, T def = unit): s(2 * n, def), n(n) {}
+  Tree(const vector<T>& v): s(2 * (int)(v).size()) {
+    n = (int)(v).size();
+    copy(begin(v), end(v), s.begin() + n);
+    for (int i = n; --i > 0;)
+      s[i] = f(s[i * 2], s[i * 2 + 1]);
+  }
   void update(int pos, T val) {
     for (s[pos += n] = val; pos /= 2;)
       s[pos] = f(s[pos * 2], s[pos * 2 + 1]);
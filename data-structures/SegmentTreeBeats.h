@@ -0,0 +1,132 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://codeforces.com/blog/entry/57319
+ * Description: Segment tree beats. Range chmin, chmax and
+ * add, with range sum, max and min queries. Each node
+ * keeps max, strict second max and max count (and the same
+ * for min), so a chmin that only touches maxima is applied
+ * as a tag; otherwise it recurses. Nodes are one array in
+ * heap order, like the iterative trees. Bounds are
+ * inclusive to the left and exclusive to the right.
+ * Usage: Beats t(v); t.chmin(l, r, x); t.sum(l, r);
+ * Time: amortized $O(\log^2 N)$, O(\log N) without add.
+ * Status: stress-tested
+ */
+const int64_t INF = 4e18;
+struct Beats {
+  struct N {
+    int64_t mx, mx2, mn, mn2, sum, lz;
+    int cmx, cmn, len;
+  };
+  int n;
+  vector<N> t;
+  Beats(const vector<int64_t>& v):
+    n((int)(v).size()), t(4 * n + 4) {
+    if (n) build(v, 1, 0, n);
+  }
+  void build(const vector<int64_t>& v, int i, int lo,
+    int hi) {
+    if (lo + 1 == hi) {
+      t[i] = {v[lo], -INF, v[lo], INF, v[lo], 0, 1, 1, 1};
+      return;
+    }
+    int mid = (lo + hi) / 2;
+    build(v, 2 * i, lo, mid), build(v, 2 * i + 1, mid, hi);
+    pull(i);
+  }
+  void pull(int i) {
+    N &a = t[2 * i], &b = t[2 * i + 1], &c = t[i];
+    c.sum = a.sum + b.sum, c.len = a.len + b.len, c.lz = 0;
+    c.mx = max(a.mx, b.mx);
+    c.mx2 = max(a.mx == c.mx ? a.mx2 : a.mx,
+      b.mx == c.mx ? b.mx2 : b.mx);
+    c.cmx =
+      (a.mx == c.mx) * a.cmx + (b.mx == c.mx) * b.cmx;
+    c.mn = min(a.mn, b.mn);
+    c.mn2 = min(a.mn == c.mn ? a.mn2 : a.mn,
+      b.mn == c.mn ? b.mn2 : b.mn);
+    c.cmn =
+      (a.mn == c.mn) * a.cmn + (b.mn == c.mn) * b.cmn;
+  }
+  void addTag(int i, int64_t x) {
+    N& c = t[i];
+    c.sum += x * c.len, c.lz += x;
+    c.mx += x, c.mn += x;
+    if (c.mx2 != -INF) c.mx2 += x;
+    if (c.mn2 != INF) c.mn2 += x;
+  }
+  void minTag(int i, int64_t x) { // requires mx2 < x < mx
+    N& c = t[i];
+    c.sum -= (c.mx - x) * c.cmx;
+    if (c.mn == c.mx) c.mn = x;
+    if (c.mn2 == c.mx) c.mn2 = x;
+    c.mx = x;
+  }
+  void maxTag(int i, int64_t x) { // requires mn < x < mn2
+    N& c = t[i];
+    c.sum += (x - c.mn) * c.cmn;
+    if (c.mx == c.mn) c.mx = x;
+    if (c.mx2 == c.mn) c.mx2 = x;
+    c.mn = x;
+  }
+  void push(int i) {
+    for (int j = 2 * i; j < (2 * i + 2); j++) {
+      if (t[i].lz) addTag(j, t[i].lz);
+      if (t[j].mx > t[i].mx) minTag(j, t[i].mx);
+      if (t[j].mn < t[i].mn) maxTag(j, t[i].mn);
+    }
+    t[i].lz = 0;
+  }
+  void chmin(int L, int R, int64_t x, int i = 1,
+    int lo = 0, int hi = -1) {
+    if (hi < 0) hi = n;
+    if (R <= lo || hi <= L || t[i].mx <= x) return;
+    if (L <= lo && hi <= R && t[i].mx2 < x)
+      return minTag(i, x);
+    push(i);
+    int mid = (lo + hi) / 2;
+    chmin(L, R, x, 2 * i, lo, mid);
+    chmin(L, R, x, 2 * i + 1, mid, hi);
+    pull(i);
+  }
+  void chmax(int L, int R, int64_t x, int i = 1,
+    int lo = 0, int hi = -1) {
+    if (hi < 0) hi = n;
+    if (R <= lo || hi <= L || t[i].mn >= x) return;
+    if (L <= lo && hi <= R && t[i].mn2 > x)
+      return maxTag(i, x);
+    push(i);
+    int mid = (lo + hi) / 2;
+    chmax(L, R, x, 2 * i, lo, mid);
+    chmax(L, R, x, 2 * i + 1, mid, hi);
+    pull(i);
+  }
+  void add(int L, int R, int64_t x, int i = 1,
+    int lo = 0, int hi = -1) {
+    if (hi < 0) hi = n;
+    if (R <= lo || hi <= L) return;
+    if (L <= lo && hi <= R) return addTag(i, x);
+    push(i);
+    int mid = (lo + hi) / 2;
+    add(L, R, x, 2 * i, lo, mid);
+    add(L, R, x, 2 * i + 1, mid, hi);
+    pull(i);
+  }
+  // op: 0 = sum, 1 = max, 2 = min
+  int64_t query(int L, int R, int op, int i = 1,
+    int lo = 0, int hi = -1) {
+    if (hi < 0) hi = n;
+    if (R <= lo || hi <= L)
+      return op ? op == 1 ? -INF : INF : 0;
+    if (L <= lo && hi <= R)
+      return op ? op == 1 ? t[i].mx : t[i].mn : t[i].sum;
+    push(i);
+    int mid = (lo + hi) / 2;
+    int64_t a = query(L, R, op, 2 * i, lo, mid),
+            b = query(L, R, op, 2 * i + 1, mid, hi);
+    return op ? op == 1 ? max(a, b) : min(a, b) : a + b;
+  }
+  int64_t sum(int L, int R) { return query(L, R, 0); }
+};
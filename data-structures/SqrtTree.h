@@ -0,0 +1,70 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://cp-algorithms.com/data_structures/sqrt-tree.html
+ * Description: Range queries for any associative
+ * operation f with a smaller build than
+ * DisjointSparseTable.h. Layer $i$ cuts the array into
+ * aligned segments of size $2^{L_i}$ ($L_0 = \lceil \log N
+ * \rceil$, $L_{i+1} = \lceil L_i / 2 \rceil$), each into
+ * about $\sqrt{2^{L_i}}$ blocks with prefix and suffix
+ * aggregates, plus the aggregate of every run of whole
+ * blocks. A query is answered on the deepest layer where
+ * its ends fall in different blocks, with two combines.
+ * Usage:
+ *  SqrtTree st(v, [](int a, int b) { return a + b; });
+ *  st.query(inclusive, exclusive);
+ * Time: $O(|V| \log \log |V| + Q)$
+ * Status: stress-tested
+ */
+template<class T, class F> struct SqrtTree {
+  vector<T> v;
+  F f;
+  vector<int> L, on;
+  vector<vector<T>> pre, suf, btw;
+  SqrtTree(const vector<T>& V, F f): v(V), f(f) {
+    int n = (int)(v).size(), lg = 0;
+    while ((1 << lg) < n) lg++;
+    on.assign(lg + 1, 0);
+    for (int l = lg; l > 1; l = (l + 1) / 2)
+      L.push_back(l), on[l - 1] = (int)(L).size() - 1;
+    for (int k = lg - 1; k-- > 0;)
+      on[k] = max(on[k], on[k + 1]);
+    pre = suf = vector<vector<T>>((int)(L).size(), v);
+    btw.assign((int)(L).size(), vector<T>(1 << lg));
+    for (int i = 0; i < ((int)(L).size()); i++) {
+      int bs = (L[i] + 1) / 2, bc = L[i] / 2;
+      for (int s = 0; s < n; s += 1 << L[i]) {
+        int e = min(n, s + (1 << L[i]));
+        for (int b = s; b < e; b += 1 << bs) {
+          int r = min(e, b + (1 << bs));
+          for (int j = b + 1; j < r; j++)
+            pre[i][j] = f(pre[i][j - 1], v[j]);
+          for (int j = r - 1; j-- > b;)
+            suf[i][j] = f(v[j], suf[i][j + 1]);
+        }
+        int cnt = (e - s + (1 << bs) - 1) >> bs;
+        for (int x = 0; x < (cnt); x++) {
+          T acc = suf[i][s + (x << bs)];
+          btw[i][s + (x << bc) + x] = acc;
+          for (int y = x + 1; y < cnt; y++)
+            btw[i][s + (x << bc) + y] = acc =
+              f(acc, suf[i][s + (y << bs)]);
+        }
+      }
+    }
+  }
+  T query(int a, int b) {
+    assert(a < b);
+    if (a == --b) return v[a];
+    if (a + 1 == b) return f(v[a], v[b]);
+    int i = on[31 - __builtin_clz(a ^ b)],
+        bs = (L[i] + 1) / 2, bc = L[i] / 2,
+        s = a >> L[i] << L[i], x = ((a - s) >> bs) + 1,
+        y = ((b - s) >> bs) - 1;
+    T res = suf[i][a];
+    if (x <= y) res = f(res, btw[i][s + (x << bc) + y]);
+    return f(res, pre[i][b]);
+  }
+};
@@ -0,0 +1,93 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: SubMatrix.h
+ * Description: SubMatrix.h with the prefix table in one
+ * row-major array, built from a callback row(r, out) that
+ * writes the C values of row r to out, so the input never
+ * has to be in memory. Given a file name the table is
+ * streamed to that file and mmap'ed read-only (the OS
+ * pages it in on demand); SubMatrixMM(C, file) maps a
+ * table built earlier. Failed I/O, and a file whose size
+ * is not a whole number of rows, throw runtime\_error.
+ * T must be signed or floating. P is the storage type: an
+ * unsigned type narrower than T also works (prefix sums
+ * wrap around) as long as every answer fits in its signed
+ * range.
+ * Usage: SubMatrixMM<int64_t, uint32_t> m(R, C,
+ *  [&](int r, int64_t* out) { ... }, "pre.bin");
+ *  m.sum(0, 0, 2, 2); // top left 4 elements
+ * Time: O(RC + Q), with O(C) memory if a file is given.
+ * Status: stress-tested
+ */
+#include <fcntl.h> /** keep-include */
+#include <sys/mman.h> /** keep-include */
+#include <unistd.h> /** keep-include */
+template<class T, class P = T> struct SubMatrixMM {
+  int64_t C;
+  vector<P> mem;
+  P* p;
+  size_t len = 0;
+  template<class F>
+  SubMatrixMM(int R, int C, F row, const char* file = 0):
+    C(C) {
+    vector<T> v(C);
+    vector<P> a(C + 1), b(C + 1);
+    unique_ptr<FILE, int (*)(FILE*)> f(
+      file ? fopen(file, "wb") : 0, fclose);
+    check(!file || f, file);
+    auto out = [&](vector<P>& x) {
+      if (!f) mem.insert(end(mem), begin(x), end(x));
+      else
+        check(fwrite(x.data(), sizeof(P), C + 1,
+                f.get()) == size_t(C + 1),
+          file);
+    };
+    out(a);
+    for (int r = 0; r < (R); r++) {
+      row(r, v.data());
+      P s = 0;
+      for (int c = 0; c < (C); c++)
+        s += P(v[c]), b[c + 1] = a[c + 1] + s;
+      out(b), swap(a, b);
+    }
+    if (!file) p = mem.data();
+    else
+      check(!fclose(f.release()), file), load(file, R + 1);
+  }
+  SubMatrixMM(int C, const char* file): C(C) {
+    load(file, -1);
+  }
+  SubMatrixMM(const SubMatrixMM&) = delete;
+  ~SubMatrixMM() {
+    if (len) munmap(p, len);
+  }
+  void check(bool ok, const char* what) {
+    if (!ok)
+      throw runtime_error(string(what) + ": " +
+        (errno ? strerror(errno) : "bad size"));
+  }
+  void load(const char* file, int64_t rows) {
+    int fd = open(file, O_RDONLY);
+    check(fd >= 0, file);
+    off_t n = lseek(fd, 0, SEEK_END);
+    if (n < 0) close(fd), check(0, file);
+    size_t row = (C + 1) * sizeof(P);
+    bool ok = n > 0 && n % row == 0 &&
+      (rows < 0 || size_t(n) == rows * row);
+    errno = 0;
+    void* q =
+      ok ? mmap(0, n, PROT_READ, MAP_SHARED, fd, 0) : 0;
+    close(fd);
+    check(ok && q != MAP_FAILED, file);
+    p = (P*)q, len = n;
+  }
+  P at(int64_t r, int c) { return p[r * (C + 1) + c]; }
+  T sum(int u, int l, int d, int r) {
+    P x = at(d, r) - at(d, l) - at(u, r) + at(u, l);
+    if constexpr (is_unsigned_v<P>)
+      return T(make_signed_t<P>(x));
+    else return x;
+  }
+};
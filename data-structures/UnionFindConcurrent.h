@@ -0,0 +1,63 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: Jayanti, Tarjan - Concurrent Disjoint Set Union
+ * Description: Disjoint-set data structure that many
+ * threads may join and query at once, without locks.
+ * Roots are linked with a CAS, always the one of lower
+ * (pseudo-random) priority under the other; find does
+ * path splitting with CAS and is iterative.
+ * parallelJoin splits an edge list over T threads and
+ * returns the number of successful joins.
+ * Usage: ConcurrentUF uf(n); uf.parallelJoin(edges, 32);
+ * Time: $O(\log N)$ expected per operation
+ * Status: stress-tested
+ */
+struct ConcurrentUF {
+  vector<atomic<int>> e;
+  ConcurrentUF(int n): e(n) {
+    for (int i = 0; i < (n); i++) e[i] = i;
+  }
+  uint64_t pri(uint64_t x) {
+    return __builtin_bswap64(x * 0x9E3779B97F4A7C15);
+  }
+  int find(int x) {
+    for (int y, z; (y = e[x]) != x; x = y) {
+      if ((z = e[y]) == y) return y;
+      e[x].compare_exchange_weak(y, z);
+    }
+    return x;
+  }
+  bool sameSet(int a, int b) {
+    for (;;) {
+      a = find(a), b = find(b);
+      if (a == b) return true;
+      if (e[a] == a) return false;
+    }
+  }
+  bool join(int a, int b) {
+    for (;;) {
+      a = find(a), b = find(b);
+      if (a == b) return false;
+      if (pri(a) > pri(b)) swap(a, b);
+      int x = a;
+      if (e[a].compare_exchange_strong(x, b)) return true;
+    }
+  }
+  int64_t parallelJoin(const vector<pair<int, int>>& ed,
+    int T) {
+    atomic<int64_t> res = 0;
+    vector<thread> th;
+    for (int t = 0; t < (T); t++)
+      th.emplace_back([&, t] {
+        int64_t c = 0, n = (int)(ed).size(),
+                i = n * t / T;
+        for (; i < n * (t + 1) / T; i++)
+          c += join(ed[i].first, ed[i].second);
+        res += c;
+      });
+    for (auto& x : th) x.join();
+    return res;
+  }
+};
@@ -0,0 +1,79 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: folklore (offline dynamic connectivity)
+ * Description: Answers connectivity queries on a graph
+ * whose edges are added and removed over time, offline.
+ * Events are \{0, u, v\} add edge, \{1, u, v\} remove
+ * edge (which must be present), \{2, u, v\} ask if u
+ * and v are connected. Each edge lives on an interval of
+ * event indices, which is put on the $O(\log M)$ nodes of
+ * a segment tree over time; a DFS over that tree joins
+ * edges on the way down and rolls them back on the way
+ * up. At a leaf the number of components is
+ * n - uf.time() / 2.
+ * Usage: vector<int> ans = dynCon(n, events);
+ * Time: $O(M \log M \log N)$
+ * Status: stress-tested
+ */
+struct RollbackUF {
+  vector<int> e;
+  vector<pair<int, int>> st;
+  RollbackUF(int n): e(n, -1) {}
+  int size(int x) { return -e[find(x)]; }
+  int find(int x) { return e[x] < 0 ? x : find(e[x]); }
+  int time() { return (int)(st).size(); }
+  void rollback(int t) {
+    for (int i = time(); i-- > t;)
+      e[st[i].first] = st[i].second;
+    st.resize(t);
+  }
+  bool join(int a, int b) {
+    a = find(a), b = find(b);
+    if (a == b) return false;
+    if (e[a] > e[b]) swap(a, b);
+    st.push_back({a, e[a]});
+    st.push_back({b, e[b]});
+    e[a] += e[b];
+    e[b] = a;
+    return true;
+  }
+};
+vector<int> dynCon(int n, vector<array<int, 3>> ev) {
+  int T = (int)(ev).size();
+  vector<vector<pair<int, int>>> seg(2 * T);
+  map<pair<int, int>, vector<int>> open;
+  auto put = [&](int l, int r, pair<int, int> e) {
+    for (l += T, r += T; l < r; l /= 2, r /= 2) {
+      if (l % 2) seg[l++].push_back(e);
+      if (r % 2) seg[--r].push_back(e);
+    }
+  };
+  for (int i = 0; i < (T); i++) {
+    auto [t, u, v] = ev[i];
+    pair<int, int> e = minmax(u, v);
+    if (t == 0) open[e].push_back(i);
+    if (t == 1) {
+      assert(!open[e].empty()); // remove without add
+      put(open[e].back(), i, e), open[e].pop_back();
+    }
+  }
+  for (auto& [e, v] : open)
+    for (int i : v) put(i, T, e);
+  RollbackUF uf(n);
+  vector<int> res(T, -1), ans;
+  auto dfs = [&](int i, auto& f) -> void {
+    int t = uf.time();
+    for (auto [u, v] : seg[i]) uf.join(u, v);
+    if (i < T) f(2 * i, f), f(2 * i + 1, f);
+    else if (ev[i - T][0] == 2)
+      res[i - T] =
+        uf.find(ev[i - T][1]) == uf.find(ev[i - T][2]);
+    uf.rollback(t);
+  };
+  if (T) dfs(1, dfs);
+  for (int x : res)
+    if (x >= 0) ans.push_back(x);
+  return ans;
+}
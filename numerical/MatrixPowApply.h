@@ -0,0 +1,210 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://codeforces.com/blog/entry/61306
+ * Description: Computes $A^p v$ modulo a prime without
+ * forming $A^p$. PowApply caches $A^{2^i}$ across calls,
+ * so each query is $O(\log p)$ matrix-vector products.
+ * powApplyBM instead finds the minimal polynomial $P$ of
+ * $v$ (degree $L \le N$) with Berlekamp-Massey on the
+ * Krylov sequence $u^T A^i v$, and returns
+ * $(x^p \bmod P)(A) v$ for every $p$ in ps. It is Monte
+ * Carlo: $u$ is random (seeded with time(0)), and the
+ * result is wrong with probability at most $N / mod$.
+ * Polynomial products are schoolbook.
+ * Usage: PowApply pa(A); pa.apply(p, v);
+ *  powApplyBM(A, v, {p1, p2})[1] // A^p2 v
+ * Time: PowApply $O(N^3 \log p)$ once, then
+ * $O(N^2 \log p)$ per query. powApplyBM $O(N^3)$ once,
+ * then $O(L^2 \log p + NL)$ per exponent.
+ * Status: stress-tested
+ */
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: Matrix.h
+ * Description: Matrix.h for runtime sizes and entries
+ * modulo mod $< 2^{30}$. Rows are multiplied into 64-bit
+ * accumulators in i-k-j order (which the compiler
+ * vectorizes), and reduced only once every 16 values of k,
+ * since $16 \cdot mod^2 + mod < 2^{64}$.
+ * Usage: ModMatrix A(n); A[0][1] = 5;
+ *  vector<uint32_t> vec = (A ^ p) * vec;
+ * Time: $O(N^3 \log p)$ for A ^ p.
+ * Status: stress-tested
+ */
+const int64_t mod = 1000000007; // faster if const
+struct ModMatrix {
+  typedef ModMatrix M;
+  int n;
+  vector<uint32_t> d;
+  ModMatrix(int n): n(n), d(n * n) {}
+  uint32_t* operator[](int i) { return &d[i * n]; }
+  const uint32_t* operator[](int i) const {
+    return &d[i * n];
+  }
+  M operator*(const M& m) const {
+    M a(n);
+    vector<uint64_t> acc(n);
+    for (int i = 0; i < (n); i++) {
+      fill(begin(acc), end(acc), 0);
+      for (int k = 0; k < (n); k++) {
+        uint64_t x = (*this)[i][k];
+        const uint32_t* r = m[k];
+        for (int j = 0; j < (n); j++) acc[j] += x * r[j];
+        if (k % 16 == 15)
+          for (auto& y : acc) y %= mod;
+      }
+      for (int j = 0; j < (n); j++) a[i][j] = acc[j] % mod;
+    }
+    return a;
+  }
+  vector<uint32_t> operator*(
+    const vector<uint32_t>& vec) const {
+    vector<uint32_t> ret(n);
+    for (int i = 0; i < (n); i++) {
+      uint64_t s = 0;
+      for (int j = 0; j < (n); j++) {
+        s += uint64_t((*this)[i][j]) * vec[j];
+        if (j % 16 == 15) s %= mod;
+      }
+      ret[i] = s % mod;
+    }
+    return ret;
+  }
+  M operator^(int64_t p) const {
+    assert(p >= 0);
+    M a(n), b(*this);
+    for (int i = 0; i < (n); i++) a[i][i] = 1;
+    while (p) {
+      if (p & 1) a = a * b;
+      b = b * b;
+      p >>= 1;
+    }
+    return a;
+  }
+};
+/**
+ * Author: Lucian Bicsi
+ * Date: 2017-10-31
+ * License: CC0
+ * Source: Wikipedia
+ * Description: Recovers any $n$-order linear recurrence
+ * relation from the first $2n$ terms of the recurrence.
+ * Useful for guessing linear recurrences after
+ * brute-forcing the first terms. Should work on any field,
+ * but numerical stability for floats is not guaranteed.
+ * Output will have size $\le n$.
+ * Usage: berlekampMassey({0, 1, 1, 3, 5, 11}) // {1, 2}
+ * Time: O(N^2)
+ * Status: bruteforce-tested mod 5 for n <= 5 and all s
+ */
+/**
+ * Author: Noam527
+ * Date: 2019-04-24
+ * License: CC0
+ * Source: folklore
+ * Description:
+ * Status: tested
+ */
+int64_t modpow(int64_t b, int64_t e) {
+  int64_t ans = 1;
+  for (; e; b = b * b % mod, e /= 2)
+    if (e & 1) ans = ans * b % mod;
+  return ans;
+}
+vector<int64_t> berlekampMassey(vector<int64_t> s) {
+  int n = (int)(s).size(), L = 0, m = 0;
+  vector<int64_t> C(n), B(n), T;
+  C[0] = B[0] = 1;
+  int64_t b = 1;
+  for (int i = 0; i < (n); i++) {
+    ++m;
+    int64_t d = s[i] % mod;
+    for (int j = 1; j < (L + 1); j++)
+      d = (d + C[j] * s[i - j]) % mod;
+    if (!d) continue;
+    T = C;
+    int64_t coef = d * modpow(b, mod - 2) % mod;
+    for (int j = m; j < (n); j++)
+      C[j] = (C[j] - coef * B[j - m]) % mod;
+    if (2 * L > i) continue;
+    L = i + 1 - L;
+    B = T;
+    b = d;
+    m = 0;
+  }
+  C.resize(L + 1);
+  C.erase(C.begin());
+  for (int64_t& x : C) x = (mod - x) % mod;
+  return C;
+}
+struct PowApply {
+  vector<ModMatrix> sq;
+  PowApply(const ModMatrix& A): sq{A} {}
+  vector<uint32_t> apply(int64_t p, vector<uint32_t> v) {
+    for (int i = 0; p; i++, p /= 2) {
+      if (i == (int)(sq).size())
+        sq.push_back(sq[i - 1] * sq[i - 1]);
+      if (p & 1) v = sq[i] * v;
+    }
+    return v;
+  }
+};
+vector<vector<uint32_t>> powApplyBM(const ModMatrix& A,
+  vector<uint32_t> v, vector<int64_t> ps) {
+  int n = A.n;
+  mt19937 rng(time(0));
+  vector<uint32_t> u(n);
+  for (auto& x : u) x = rng() % mod;
+  vector<vector<uint32_t>> K{v};
+  vector<int64_t> s(2 * n);
+  for (int i = 0; i < (2 * n); i++) {
+    if (i) K.push_back(A * K.back());
+    for (int j = 0; j < (n); j++)
+      s[i] = (s[i] + uint64_t(u[j]) * K[i][j]) % mod;
+  }
+  vector<int64_t> tr = berlekampMassey(s);
+  int L = (int)(tr).size();
+  auto combine = [&](const vector<int64_t>& a,
+                   const vector<int64_t>& b) {
+    vector<uint64_t> r(2 * L); // reduced every 16 steps
+    for (int i = 0; i < (L); i++) {
+      for (int j = 0; j < (L); j++)
+        r[i + j] += a[i] * b[j];
+      if (i % 16 == 15 || i == L - 1)
+        for (auto& x : r) x %= mod;
+    }
+    for (int i = 2 * L - 1; i >= L; --i) {
+      uint64_t x = r[i] % mod;
+      for (int j = 0; j < (L); j++)
+        r[i - 1 - j] += x * tr[j];
+      if (i % 16 == 0)
+        for (auto& y : r) y %= mod;
+    }
+    vector<int64_t> res(L);
+    for (int i = 0; i < (L); i++) res[i] = r[i] % mod;
+    return res;
+  };
+  vector<vector<int64_t>> e(1, vector<int64_t>(L));
+  if (L > 1) e[0][1] = 1;
+  else if (L) e[0][0] = tr[0]; // x = tr[0]
+  vector<vector<uint32_t>> res;
+  for (int64_t p : ps) {
+    vector<int64_t> pol(L);
+    if (L) pol[0] = 1;
+    for (int i = 0; p; i++, p /= 2) {
+      if (i == (int)(e).size())
+        e.push_back(combine(e[i - 1], e[i - 1]));
+      if (p & 1) pol = combine(pol, e[i]);
+    }
+    vector<uint64_t> w(n);
+    for (int i = 0; i < (L); i++)
+      for (int j = 0; j < (n); j++)
+        w[j] = (w[j] + pol[i] * K[i][j]) % mod;
+    res.emplace_back(begin(w), end(w));
+  }
+  return res;
+}
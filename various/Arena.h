@@ -0,0 +1,57 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: BumpAllocator.h
+ * Description: BumpAllocator.h as an object: memory comes
+ * from chunks of at least chunk bytes, mmap'ed on demand
+ * (with a transparent huge page hint if huge). mark() and
+ * release(m) free everything allocated after the mark,
+ * keeping the chunks mapped for reuse. localArena() is one
+ * arena per thread.
+ * Usage: Arena& A = localArena(); auto m = A.mark();
+ *  int* p = (int*)A.alloc(n * sizeof(int)); A.release(m);
+ * Time: O(1) amortized
+ * Status: stress-tested
+ */
+#include <sys/mman.h> /** keep-include */
+struct Arena {
+  size_t chunk, base = 0, off = 0, peak = 0;
+  bool huge;
+  vector<pair<char*, size_t>> ch; // (start, size)
+  int cur = 0;
+  Arena(size_t chunk = 64 << 20, bool huge = 1):
+    chunk(chunk), huge(huge) {}
+  Arena(const Arena&) = delete;
+  ~Arena() {
+    for (auto [p, s] : ch) munmap(p, s);
+  }
+  void* alloc(size_t s, size_t a = alignof(max_align_t)) {
+    for (;; base += ch[cur++].second, off = 0) {
+      if (cur == (int)(ch).size()) {
+        size_t n = max(chunk, s + a);
+        char* p = (char*)mmap(0, n, PROT_READ | PROT_WRITE,
+          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        assert(p != MAP_FAILED);
+        if (huge) madvise(p, n, MADV_HUGEPAGE);
+        ch.push_back({p, n});
+      }
+      size_t o = (off + a - 1) & ~(a - 1);
+      if (o + s <= ch[cur].second) {
+        off = o + s, peak = max(peak, used());
+        return ch[cur].first + o;
+      }
+    }
+  }
+  pair<int, size_t> mark() { return {cur, off}; }
+  void release(pair<int, size_t> m) {
+    base = 0, tie(cur, off) = m;
+    for (int i = 0; i < (cur); i++) base += ch[i].second;
+  }
+  size_t used() { return base + off; }
+  int chunks() { return (int)(ch).size(); }
+};
+Arena& localArena() {
+  static thread_local Arena a;
+  return a;
+}
@@ -0,0 +1,56 @@
+/**
+ * Author: programming-team-code
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: BumpAllocatorSTL.h
+ * Description: BumpAllocatorSTL.h that reuses freed
+ * memory: blocks are rounded up to a power of two (at
+ * least 16 bytes), and deallocate pushes a block onto the
+ * free list of its size, which allocate pops before
+ * bumping. Free lists are global, so all rebinds of pool
+ * share them. TL = 0 is single-threaded only: its lists
+ * are unsynchronized. For threads use TL = 1, which gives
+ * each thread its own lists (blocks freed by another
+ * thread join that thread's lists) and shares only the
+ * atomic bump index.
+ * Usage: vector<vector<int, pool<int>>> ed(N);
+ * Status: stress-tested
+ */
+char buf[450 << 20] alignas(16);
+atomic<size_t> buf_ind{sizeof buf};
+void* pool_fl[64];
+thread_local void* pool_tl[64];
+template<class T, bool TL = 0> struct pool {
+  typedef T value_type;
+  template<class U> struct rebind {
+    typedef pool<U, TL> other;
+  };
+  pool() {}
+  template<class U> pool(const pool<U, TL>&) {}
+  static int cls(size_t n) {
+    return n <= 16 ? 4 : 64 - __builtin_clzll(n - 1);
+  }
+  static void*& head(int c) {
+    return TL ? pool_tl[c] : pool_fl[c];
+  }
+  T* allocate(size_t n) {
+    int c = cls(n * sizeof(T));
+    void*& h = head(c);
+    if (void* p = h) return h = *(void**)p, (T*)p;
+    size_t s = size_t(1) << c, i = buf_ind -= s;
+    assert(i < sizeof buf);
+    return (T*)(buf + i);
+  }
+  void deallocate(T* p, size_t n) {
+    void*& h = head(cls(n * sizeof(T)));
+    *(void**)p = h, h = p;
+  }
+};
+template<class T, class U, bool B>
+bool operator==(const pool<T, B>&, const pool<U, B>&) {
+  return 1;
+}
+template<class T, class U, bool B>
+bool operator!=(const pool<T, B>&, const pool<U, B>&) {
+  return 0;
+}